@@ -28,6 +28,9 @@ libgtkIOStream().then((Module)=>{
   fs=48000;
   WSOLA.setFS(fs);
 
+  // trade search quality for speed on slow devices, 1 is exact, lower is faster
+  WSOLA.setQuality(0.25);
+
   timeScale=1.2; // This value specifies whether to speed up or slow down the audio
 
   // The number of audio sames to load initially